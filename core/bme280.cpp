@@ -0,0 +1,301 @@
+#include "bme280.h"
+#include "registres.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+using namespace Registres;
+
+// Données de calibration, dans l'ordre des champs ci-dessous
+enum champ_calibration {
+    DIG_T1, DIG_T2, DIG_T3,
+    DIG_P1, DIG_P2, DIG_P3, DIG_P4, DIG_P5, DIG_P6, DIG_P7, DIG_P8, DIG_P9,
+    DIG_H1, DIG_H2, DIG_H3, DIG_H4_MSB, DIG_H4_LSB, DIG_H5, DIG_H6
+};
+
+constexpr Champ champsCalibration[] = {
+    Mot16(0x88, PETIT_BOUTIEN),             // dig_T1
+    Mot16(0x8A, PETIT_BOUTIEN, true),       // dig_T2
+    Mot16(0x8C, PETIT_BOUTIEN, true),       // dig_T3
+
+    Mot16(0x8E, PETIT_BOUTIEN),             // dig_P1
+    Mot16(0x90, PETIT_BOUTIEN, true),       // dig_P2
+    Mot16(0x92, PETIT_BOUTIEN, true),       // dig_P3
+    Mot16(0x94, PETIT_BOUTIEN, true),       // dig_P4
+    Mot16(0x96, PETIT_BOUTIEN, true),       // dig_P5
+    Mot16(0x98, PETIT_BOUTIEN, true),       // dig_P6
+    Mot16(0x9A, PETIT_BOUTIEN, true),       // dig_P7
+    Mot16(0x9C, PETIT_BOUTIEN, true),       // dig_P8
+    Mot16(0x9E, PETIT_BOUTIEN, true),       // dig_P9
+
+    Octet(0xA1),                            // dig_H1
+    Mot16(0xE1, PETIT_BOUTIEN, true),       // dig_H2
+    Octet(0xE3),                            // dig_H3
+    Octet(0xE4),                            // dig_H4 bits 11..4
+    Bits(0xE5, 1, GRAND_BOUTIEN, 0, 4),     // dig_H4 bits 3..0
+    Bits(0xE5, 2, PETIT_BOUTIEN, 4, 12),    // dig_H5
+    Octet(0xE7, true)                       // dig_H6
+};
+
+// Le registre 0xA0 est lu en plus pour joindre dig_H1 au premier bloc
+constexpr auto planCalibration = CalculerPlan(champsCalibration, TAILLE_ESPACE_REGISTRES, 1);
+static_assert(planCalibration.nbBlocs == 2, "Calibration : 0x88-0xA1 et 0xE1-0xE7");
+
+// Mesures brutes
+constexpr Champ champsPression[]    = { Bits(0xF7, 3, GRAND_BOUTIEN, 4, 20) };
+constexpr Champ champsTemperature[] = { Bits(0xFA, 3, GRAND_BOUTIEN, 4, 20) };
+constexpr Champ champsHumidite[]    = { Mot16(0xFD, GRAND_BOUTIEN) };
+
+constexpr auto planPression    = CalculerPlan(champsPression);
+constexpr auto planTemperature = CalculerPlan(champsTemperature);
+constexpr auto planHumidite    = CalculerPlan(champsHumidite);
+
+}
+
+BME280::BME280(I2cBus *busComm, const uint8_t _I2CAdress) {
+
+    uint8_t composantID;
+    bool composantOk = false;
+
+    commInterface = busComm;
+    I2CAddress = _I2CAdress; //Default, jumper open is 0x77
+
+    usleep(2000); // delay de 2ms pour laiser le temps au capteur de démarrer
+
+    commInterface->CommencerTransmission(I2CAddress);
+    composantID = commInterface->LireRegistre(BME280_CHIP_ID_REG);
+
+    if (composantID == BMP280_ID || composantID == BME280_ID)
+        composantOk = true;
+    else
+        std::cerr << "Le composant n'est pas présent" << std::endl;
+
+    commInterface->TerminerTransmission();
+
+
+
+    if (composantOk)
+    {
+        while(CalibrationEnCourt())
+            usleep(1000);
+
+        Calibrer();
+        Configurer();
+        usleep(3000);
+    }
+}
+
+BME280::~BME280() {
+}
+
+void BME280::Calibrer() {
+    uint8_t buffer[planCalibration.taille];
+
+    commInterface->CommencerTransmission(I2CAddress);
+    if (Lire(*commInterface, planCalibration, buffer)) {
+        dig_T1 = Decoder(planCalibration, DIG_T1, buffer);
+        dig_T2 = Decoder(planCalibration, DIG_T2, buffer);
+        dig_T3 = Decoder(planCalibration, DIG_T3, buffer);
+
+        dig_P1 = Decoder(planCalibration, DIG_P1, buffer);
+        dig_P2 = Decoder(planCalibration, DIG_P2, buffer);
+        dig_P3 = Decoder(planCalibration, DIG_P3, buffer);
+        dig_P4 = Decoder(planCalibration, DIG_P4, buffer);
+        dig_P5 = Decoder(planCalibration, DIG_P5, buffer);
+        dig_P6 = Decoder(planCalibration, DIG_P6, buffer);
+        dig_P7 = Decoder(planCalibration, DIG_P7, buffer);
+        dig_P8 = Decoder(planCalibration, DIG_P8, buffer);
+        dig_P9 = Decoder(planCalibration, DIG_P9, buffer);
+
+        dig_H1 = Decoder(planCalibration, DIG_H1, buffer);
+        dig_H2 = Decoder(planCalibration, DIG_H2, buffer);
+        dig_H3 = Decoder(planCalibration, DIG_H3, buffer);
+        dig_H4 = (Decoder(planCalibration, DIG_H4_MSB, buffer) << 4) | Decoder(planCalibration, DIG_H4_LSB, buffer);
+        dig_H5 = Decoder(planCalibration, DIG_H5, buffer);
+        dig_H6 = Decoder(planCalibration, DIG_H6, buffer);
+    }
+    commInterface->TerminerTransmission();
+}
+
+void BME280::FixerMode(BME280::sensor_mode mode) {
+
+    commInterface->CommencerTransmission(I2CAddress);
+    uint8_t controlData = commInterface->LireRegistre(BME280_CTRL_MEAS_REG);
+    controlData &= ~(MODE_NORMAL); // Remise à 0 des 2 premiers bits
+    controlData |= mode;
+    commInterface->EcrireRegistre(BME280_CTRL_MEAS_REG, controlData);
+    commInterface->TerminerTransmission();
+
+}
+
+BME280::sensor_mode BME280::ObtenirMode()
+{
+    commInterface->CommencerTransmission(I2CAddress);
+    uint8_t controlData = commInterface->LireRegistre(BME280_CTRL_MEAS_REG) & 0b00000011;
+    commInterface->TerminerTransmission();
+    return (sensor_mode) controlData ;
+}
+
+void BME280::Configurer(BME280::sensor_sampling temperature,
+                        BME280::sensor_sampling humidite,
+                        BME280::sensor_sampling pression,
+                        BME280::sensor_filter filtre)
+{
+    commInterface->CommencerTransmission(I2CAddress);
+    commInterface->EcrireRegistre(BME280_CTRL_HUMIDITY_REG, humidite);
+
+    uint8_t configData = commInterface->LireRegistre(BME280_CONFIG_REG);
+    configData &= ~( (1<<4) | (1<<3) | (1<<2) ); //remise à 0 des bits 4/3/2
+    configData |= (filtre << 2); //Alignement des bits 4/3/2
+    commInterface->EcrireRegistre(BME280_CONFIG_REG, configData);
+    uint8_t controlData = temperature << 5 | pression << 2 | MODE_NORMAL ;
+    commInterface->EcrireRegistre(BME280_CTRL_MEAS_REG,controlData);
+
+    commInterface->TerminerTransmission();
+}
+
+float BME280::LireTemperatureC() {
+    uint8_t buffer[planTemperature.taille];
+    uint32_t adc_T;
+    float sortie = 0.0;
+
+    commInterface->CommencerTransmission(I2CAddress);
+    if (Lire(*commInterface, planTemperature, buffer)) {
+        adc_T = Decoder(planTemperature, 0, buffer);
+
+        int64_t var1, var2;
+        var1 = ((((adc_T >> 3) - ((uint32_t) dig_T1 << 1))) * ((uint32_t) dig_T2)) >> 11;
+        var2 = (((((adc_T >> 4) - ((uint32_t) dig_T1)) * ((adc_T >> 4) - ((uint32_t) dig_T1))) >> 12) *
+                ((uint32_t) dig_T3)) >> 14;
+        t_fine = var1 + var2;
+
+        sortie = (t_fine * 5 + 128) >> 8;
+        sortie /= 100.0;
+    }
+    commInterface->TerminerTransmission();
+
+
+    return sortie;
+}
+
+float BME280::LireHumiditeRelative() {
+    uint8_t buffer[planHumidite.taille];
+    uint32_t var1 = 0.0;
+
+    commInterface->CommencerTransmission(I2CAddress);
+    if (Lire(*commInterface, planHumidite, buffer)) {
+
+        uint32_t adc_H = Decoder(planHumidite, 0, buffer);
+
+        var1 = (t_fine - ((uint32_t) 76800));
+        var1 = (((((adc_H << 14) - (((uint32_t) dig_H4) << 20) - (((uint32_t) dig_H5) * var1)) +
+                  ((uint32_t) 16384)) >> 15) * (((((((var1 * ((uint32_t) dig_H6)) >> 10) *
+                                                   (((var1 * ((uint32_t) dig_H3)) >> 11) + ((uint32_t) 32768))) >> 10) + ((uint32_t) 2097152)) *
+                                                ((uint32_t) dig_H2) + 8192) >> 14));
+        var1 = (var1 - (((((var1 >> 15) * (var1 >> 15)) >> 7) * ((uint32_t) dig_H1)) >> 4));
+        var1 = (var1 < 0.0 ? 0 : var1);
+        var1 = (var1 > 419430400 ? 419430400 : var1);
+    }
+    commInterface->TerminerTransmission();
+
+
+    return (float) (var1 >> 12) / 1024.0;
+}
+
+float BME280::LirePression() {
+    uint8_t buffer[planPression.taille];
+    float sortie = 0.0;
+
+    commInterface->CommencerTransmission(I2CAddress);
+    if (Lire(*commInterface, planPression, buffer)) {
+        uint32_t adc_P = Decoder(planPression, 0, buffer);
+
+        int64_t var1, var2, p_acc;
+        var1 = ((int64_t) t_fine) - 128000;
+        var2 = var1 * var1 * (int64_t) dig_P6;
+        var2 = var2 + ((var1 * (int64_t) dig_P5) << 17);
+        var2 = var2 + (((int64_t) dig_P4) << 35);
+        var1 = ((var1 * var1 * (int64_t) dig_P3) >> 8) + ((var1 * (int64_t) dig_P2) << 12);
+        var1 = (((((int64_t) 1) << 47) + var1))*((int64_t) dig_P1) >> 33;
+        if (var1 == 0)
+            sortie = 0.0;
+        else {
+            p_acc = 1048576 - adc_P;
+            p_acc = (((p_acc << 31) - var2)*3125) / var1;
+            var1 = (((int64_t) dig_P9) * (p_acc >> 13) * (p_acc >> 13)) >> 25;
+            var2 = (((int64_t) dig_P8) * p_acc) >> 19;
+            p_acc = ((p_acc + var1 + var2) >> 8) + (((int64_t) dig_P7) << 4);
+            sortie = p_acc / 25600.0;
+        }
+    }
+    commInterface->TerminerTransmission();
+
+    return sortie;
+}
+
+/**
+ * @brief BME280::CalculerPointDeRosee
+ * @return  Valeur de la température du point de rosée
+ * @details La temperature de rosée est la température la plus basse
+ *          à laquelle une masse d'air peut etre soumise,
+ *          à pression et humidité données, sans qu'il ne se produise
+ *          une formation de condensation.
+ *
+ *          Formule de Heinrich Gustav Magnus-Tetens
+ */
+float BME280::CalculerPointDeRosee() {
+
+    float tAir = LireTemperatureC();
+    float hRelative = LireHumiditeRelative()/100.0 ;
+
+    float a = 17.27;
+    float b = 237.7;
+    float z1 = (a*tAir)/(b+tAir) + log (hRelative);
+    return b*z1 / (a - z1);
+}
+
+/**
+ * @brief BME280::CalculerPointDeGivrage
+ * @return valeur de la température du point de gelée
+ * @details Le point de givrage ou point de gelée représente
+ *          tout en gardant inchangées les conditions barométriques courantes,
+ *          l'air devient saturé de vapeur d'eau par rapport à la glace.
+ *          C'est la température ou se produit le phénomène de déposition
+ *          qui créé la gelée blanche.
+ *
+ *          Applicable uniquement lorsque la température est sous le point
+ *          de congélation soit 0 °C.
+ */
+float BME280::CalculerPointDeGivrage()
+{
+    float tAir = LireTemperatureC() + 273.15 ; // exprimé en Kelvin
+    float z1 = (2954.61 / tAir) + 2.193665 * log (tAir) - 13.3448 ;
+    float z2 = (CalculerPointDeRosee() + 273.15) - tAir ;
+    return (z2 + 2671.02 / z1 - 273.15); // Converti en °C
+}
+
+
+void BME280::Reset()
+{
+    commInterface->CommencerTransmission(I2CAddress);
+    commInterface->EcrireRegistre(BME280_RST_REG, 0xB6);
+    commInterface->TerminerTransmission();
+
+}
+
+bool BME280::CalibrationEnCourt()
+{
+    commInterface->CommencerTransmission(I2CAddress);
+    uint8_t status = commInterface->LireRegistre(BME280_STAT_REG);
+    commInterface->TerminerTransmission();
+
+    return (status & (1<<0)) != 0 ;
+}
+
+void BME280::Version() {
+
+    std::cout << "\nBME280 PSR - PCT 2018 Version 1.5\n" << std::endl;
+
+}
@@ -1,8 +1,8 @@
 #ifndef BME280_H
 #define BME280_H
 
-#include <QtGlobal>
-#include "qi2cbus.h"
+#include <cstdint>
+#include "i2cbus.h"
 
 #define BME280_ID   0x60
 #define BMP280_ID   0x58
@@ -10,41 +10,14 @@
 
 
 //Nom des registres :
-#define BME280_REGISTER_DIG_T1  0x88
-#define BME280_REGISTER_DIG_T2  0x8A
-#define BME280_REGISTER_DIG_T3  0x8C
-
-#define BME280_REGISTER_DIG_P1  0x8E
-#define BME280_REGISTER_DIG_P2  0x90
-#define BME280_REGISTER_DIG_P3  0x92
-#define BME280_REGISTER_DIG_P4  0x94
-#define BME280_REGISTER_DIG_P5  0x96
-#define BME280_REGISTER_DIG_P6  0x98
-#define BME280_REGISTER_DIG_P7  0x9A
-#define BME280_REGISTER_DIG_P8  0x9C
-#define BME280_REGISTER_DIG_P9  0x9E
-
-#define BME280_REGISTER_DIG_H1  0xA1
-#define BME280_REGISTER_DIG_H2  0xE1
-#define BME280_REGISTER_DIG_H3  0xE3
-#define BME280_REGISTER_DIG_H4  0xE4
-#define BME280_REGISTER_DIG_H5  0xE5
-#define BME280_REGISTER_DIG_H6  0xE7
-
+// Les registres de calibration et de mesure sont décrits sous forme de
+// champs (voir registres.h) dans bme280.cpp
 #define BME280_CHIP_ID_REG		    0xD0 //Chip ID
 #define BME280_RST_REG			    0xE0 //Softreset Reg
 #define BME280_CTRL_HUMIDITY_REG    0xF2 //Ctrl Humidity Reg
 #define BME280_STAT_REG             0xF3 //Status Reg
 #define BME280_CTRL_MEAS_REG        0xF4 //Ctrl Measure Reg
 #define BME280_CONFIG_REG           0xF5 //Configuration Reg
-#define BME280_PRESSURE_MSB_REG     0xF7 //Pressure MSB
-#define BME280_PRESSURE_LSB_REG     0xF8 //Pressure LSB
-#define BME280_PRESSURE_XLSB_REG    0xF9 //Pressure XLSB
-#define BME280_TEMPERATURE_MSB_REG  0xFA //Temperature MSB
-#define BME280_TEMPERATURE_LSB_REG  0xFB //Temperature LSB
-#define BME280_TEMPERATURE_XLSB_REG 0xFC //Temperature XLSB
-#define BME280_HUMIDITY_MSB_REG     0xFD //Humidity MSB
-#define BME280_HUMIDITY_LSB_REG     0xFE //Humidity LSB
 
 class BME280 {
 public:
@@ -82,7 +55,7 @@ public:
                 STANDBY_MS_1000 = 0b101
     };
 
-    BME280(Qi2cBus *busComm, const quint8 _I2CAdress = 0x77);
+    BME280(I2cBus *busComm, const uint8_t _I2CAdress = 0x77);
     virtual ~BME280();
 
     void Calibrer();
@@ -110,33 +83,33 @@ public:
 private:
 
     //Main Interface and mode settings
-    Qi2cBus *commInterface;
-    quint8 I2CAddress;
+    I2cBus *commInterface;
+    uint8_t I2CAddress;
 
     // Données de calibration
-    quint16 dig_T1;
-    qint16  dig_T2;
-    qint16  dig_T3;
-
-    quint16 dig_P1;
-    qint16  dig_P2;
-    qint16  dig_P3;
-    qint16  dig_P4;
-    qint16  dig_P5;
-    qint16  dig_P6;
-    qint16  dig_P7;
-    qint16  dig_P8;
-    qint16  dig_P9;
-
-    quint8  dig_H1;
-    qint16  dig_H2;
-    quint8  dig_H3;
-    qint16  dig_H4;
-    qint16  dig_H5;
-    qint8   dig_H6;
+    uint16_t dig_T1;
+    int16_t  dig_T2;
+    int16_t  dig_T3;
+
+    uint16_t dig_P1;
+    int16_t  dig_P2;
+    int16_t  dig_P3;
+    int16_t  dig_P4;
+    int16_t  dig_P5;
+    int16_t  dig_P6;
+    int16_t  dig_P7;
+    int16_t  dig_P8;
+    int16_t  dig_P9;
+
+    uint8_t  dig_H1;
+    int16_t  dig_H2;
+    uint8_t  dig_H3;
+    int16_t  dig_H4;
+    int16_t  dig_H5;
+    int8_t   dig_H6;
 
     // Valeur de la température
-    qint32 t_fine;
+    int32_t t_fine;
 
 
 };
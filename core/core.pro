@@ -0,0 +1,19 @@
+# Bibliothèque de base : bus I2c, pilotes et calculs de compensation.
+# Aucune dépendance au framework Qt.
+CONFIG -= qt
+
+CONFIG += c++14
+CONFIG += staticlib
+
+TARGET = CapteursI2CCore
+
+TEMPLATE = lib
+
+SOURCES += i2cbus.cpp \
+    i2cexception.cpp \
+    bme280.cpp
+
+HEADERS += \
+    i2cbus.h \
+    i2cexception.h \
+    bme280.h
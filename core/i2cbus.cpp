@@ -0,0 +1,342 @@
+/**
+ * @file    i2cbus.cpp
+ * @brief   Classe pour gérer le bus i2C sans dépendance au framework QT
+ * @author  Philippe CRUCHET (LPO Touchard-Washington - Le MANS)
+ * @date    15 aout 2018
+ * @version 1.0
+ */
+
+#include "i2cbus.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+constexpr uint16_t I2cBus::TAILLE_BLOC_SMBUS;
+constexpr uint16_t I2cBus::TAILLE_BLOC_BRUT;
+
+/**
+ * @brief I2cBus::I2cBus
+ * @param _i2cDev       Nom du fichier désignant le bus i2c (/dev/i2c-X avec X = 0,1,2...)
+ * @param _gestionnaire Fonction appelée en cas d'erreur sur le bus
+ *
+ * @details Ouvre le fichier en question et interroge l'adaptateur pour savoir
+ *          s'il accepte les transferts I2c bruts.
+ */
+I2cBus::I2cBus(const char *_i2cDev, GestionnaireErreur _gestionnaire) :
+    i2cDev(_i2cDev),
+    gestionnaire(_gestionnaire)
+{
+    try
+    {
+        if ((fichierI2c = open(i2cDev.c_str(), O_RDWR)) < 0)
+            throw I2cException(errno, " Erreur d'ouverture de %s", i2cDev.c_str());
+
+        unsigned long fonctions = 0;
+        if (ioctl(fichierI2c, I2C_FUNCS, &fonctions) == 0)
+            transfertBrut = (fonctions & I2C_FUNC_I2C) != 0;
+    }
+    catch (I2cException const& e)
+    {
+        gestionnaire(e);
+    }
+}
+
+/**
+ * @brief I2cBus::CommencerTransmission
+ * @param _adresse  Adresse du composant
+ *
+ * @details Fonction bloquante, Permet de commencer une transmission sur le bus i2c.
+ *
+ */
+void I2cBus::CommencerTransmission(uint8_t _adresse)
+{
+    mutex.lock();
+    adresse = _adresse;
+    try
+    {
+        if (ioctl(fichierI2c, I2C_SLAVE, _adresse) < 0)
+            throw I2cException(errno, " Erreur affectation adresse %u", _adresse);
+    }
+    catch (I2cException const& e)
+    {
+        gestionnaire(e);
+    }
+}
+
+/**
+ * @brief I2cBus::TerminerTransmission
+ *
+ * @details Libère le bus I2c pour l'utilisation par un autre capteur.
+ */
+void I2cBus::TerminerTransmission()
+{
+    mutex.unlock();
+}
+
+/**
+ * @brief I2cBus::~I2cBus
+ *
+ * @details Destructeur de la classe ferme le fichier
+ */
+I2cBus::~I2cBus()
+{
+    close(fichierI2c);
+}
+
+/**
+ * @brief I2cBus::LireRegistre
+ * @param  _registre  Adresse du registre à lire dans le composant.
+ * @return            Valeur du registre sous la forme d'un octet non signé,
+ *                    0 en cas d'erreur si le gestionnaire d'erreur rend la main.
+ *
+ * @details Lit la valeur du registre passé en paramètre. L'appel de la méthode
+ *          CommencerTransmission(uint8_t registre) est nécessaire avant pour
+ *          désigner l'adresse du composant et prendre le bus pour l'échange.
+ *          Plusieurs lecture sont possibles sur le meme composant avant de libérer
+ *          le bus I2c avec la méthode TerminerTransmission().
+ */
+uint8_t I2cBus::LireRegistre(uint8_t _registre)
+{
+    union i2c_smbus_data data;
+
+    data.byte = 0;      // Valeur renvoyée si le gestionnaire d'erreur rend la main
+    try {
+        if (i2c_smbus_access(I2C_SMBUS_READ, _registre, I2C_SMBUS_BYTE_DATA, &data) < 0)
+            throw I2cException(errno, " Erreur Lecture registre 8 bits n° %u", _registre);
+    } catch (I2cException const& e) {
+        gestionnaire(e);
+    }
+    return data.byte & 0xFF;
+}
+
+/**
+ * @brief I2cBus::EcrireRegistre
+ * @param _registre  Adresse du registre à modifier
+ * @param _valeur    octet à déposer dans le registre spécifié
+ * @return           0 si l'écriture c'est bien effectuée, sinon le gestionnaire d'erreur est appelé
+ *
+ * @details Ecrit la valeur dans le registre passé en paramètre. L'appel de la méthode
+ *          CommencerTransmission(uint8_t registre) est nécessaire avant pour
+ *          désigner l'adresse du composant et prendre le bus pour l'échange.
+ *          Plusieurs lecture sont possibles sur le meme composant avant de libérer
+ *          le bus I2c avec la méthode TerminerTransmission().
+ */
+int I2cBus::EcrireRegistre(uint8_t _registre, uint8_t _valeur)
+{
+    union i2c_smbus_data data;
+
+    int retour;
+    data.byte = _valeur;
+    try
+    {
+        if ((retour = i2c_smbus_access(I2C_SMBUS_WRITE, _registre, I2C_SMBUS_BYTE_DATA, &data)) < 0)
+            throw I2cException(errno, " Erreur Ecriture registre 8 bits n° %u", _registre);
+    }
+    catch (I2cException const& e)
+    {
+        gestionnaire(e);
+    }
+    return retour;
+}
+
+/**
+ * @brief I2cBus::LireBlocRegistres
+ * @param _registre   Adresse du bloc de registre à lire
+ * @param _valeurs    pointeur sur les valeurs lus
+ * @param _taille     nombre d'octets à lire
+ * @param _mode       chemin utilisé pour la lecture
+ * @param _adressage  ADRESSAGE_INCREMENTE pour des registres contigus,
+ *                    ADRESSAGE_FIXE pour relire le même registre (FIFO)
+ * @return            nombre d'octets lus
+ *
+ * @details Lit les valeur dans les registres contigus à celui passé enparamètre,
+ *          ou dans le seul registre _registre en adressage fixe.
+ *          En mode TRANSFERT_AUTO, le transfert brut est utilisé lorsque l'adaptateur
+ *          le permet, sinon la lecture passe par l'émulation SMBus.
+ *          La lecture est découpée en échanges de TAILLE_BLOC_SMBUS ou TAILLE_BLOC_BRUT
+ *          octets ; chaque échange commence au registre suivant le précédent en adressage
+ *          incrémenté, ou de nouveau à _registre en adressage fixe, quel que soit le chemin.
+ *          En adressage incrémenté, une lecture dépassant le registre 0xFF est refusée.
+ *          L'appel de la méthode CommencerTransmission(uint8_t registre) est nécessaire
+ *          avant pour désigner l'adresse du composant et prendre le bus pour l'échange.
+ *          Plusieurs lecture sont possibles sur le meme composant avant de libérer
+ *          le bus I2c avec la méthode TerminerTransmission().
+ */
+int I2cBus::LireBlocRegistres(uint8_t _registre, uint8_t *_valeurs, uint16_t _taille,
+                              mode_transfert _mode, mode_adressage _adressage)
+{
+    bool brut = _mode == TRANSFERT_BRUT || (_mode == TRANSFERT_AUTO && transfertBrut);
+    uint16_t tailleBloc = brut ? TAILLE_BLOC_BRUT : TAILLE_BLOC_SMBUS;
+    int total = 0;
+
+    try
+    {
+        if (_adressage == ADRESSAGE_INCREMENTE && _registre + _taille > 0x100)
+            throw I2cException(EINVAL, " Erreur Lecture d'un block n° %u : %u octets dépassent le registre 0xFF",
+                               _registre, _taille);
+    }
+    catch (I2cException const& e)
+    {
+        gestionnaire(e);
+        return 0;
+    }
+
+    while (total < _taille)
+    {
+        uint16_t taille = _taille - total > tailleBloc ? tailleBloc : _taille - total;
+        uint8_t registre = _adressage == ADRESSAGE_FIXE ? _registre : _registre + total;
+        int lus = brut ? LireBlocBrut(registre, _valeurs + total, taille)
+                       : LireBlocSMBus(registre, _valeurs + total, taille);
+
+        total += lus;
+        if (lus < taille)
+            break;
+    }
+    return total;
+}
+
+/**
+ * @brief I2cBus::TransfertBrutDisponible
+ * @return  vrai si l'adaptateur accepte les transferts I2c bruts (I2C_FUNC_I2C)
+ */
+bool I2cBus::TransfertBrutDisponible() const
+{
+    return transfertBrut;
+}
+
+/**
+ * @brief I2cBus::LireRegistre16
+ * @param _registre Adresse du registre à lire
+ * @return          Valeur sur 16 bits du registre lu, 0 en cas d'erreur
+ *                  si le gestionnaire d'erreur rend la main.
+ *
+ * @details Lit la valeur du registre passé en paramètre. L'appel de la méthode
+ *          CommencerTransmission(uint8_t registre) est nécessaire avant pour
+ *          désigner l'adresse du composant et prendre le bus pour l'échange.
+ *          Plusieurs lecture sont possibles sur le meme composant avant de libérer
+ *          le bus I2c avec la méthode TerminerTransmission().
+ */
+uint16_t I2cBus::LireRegistre16(uint8_t _registre)
+{
+    union i2c_smbus_data data;
+
+    data.word = 0;      // Valeur renvoyée si le gestionnaire d'erreur rend la main
+    try
+    {
+        if ((i2c_smbus_access (I2C_SMBUS_READ, _registre, I2C_SMBUS_WORD_DATA, &data)) < 0)
+            throw I2cException(errno, " Erreur Lecture registre 16 bits n° %u", _registre);
+    }
+    catch (I2cException const& e)
+    {
+        gestionnaire(e);
+    }
+    return data.word & 0xFFFF ;
+}
+
+/**
+ * @brief I2cBus::GererErreur
+ * @param _erreur   Exception décrivant l'erreur survenue sur le bus
+ *
+ * @details Gestionnaire d'erreur par défaut : affiche l'erreur sur la sortie
+ *          d'erreur et termine le programme avec le code d'erreur.
+ */
+void I2cBus::GererErreur(const I2cException &_erreur)
+{
+    std::cerr << _erreur.what() << std::endl;
+    exit(_erreur.ObtenirCode());
+}
+
+/**
+ * @brief I2cBus::LireBlocSMBus
+ * @param _registre Adresse du bloc de registre à lire
+ * @param _valeurs  pointeur sur les valeurs lus
+ * @param _taille   nombre d'octets à lire (au plus TAILLE_BLOC_SMBUS)
+ * @return          nombre d'octets lus
+ *
+ * @details Lecture d'un bloc par l'émulation SMBus.
+ */
+int I2cBus::LireBlocSMBus(uint8_t _registre, uint8_t *_valeurs, uint16_t _taille)
+{
+    union i2c_smbus_data data;
+
+    data.block[0] = _taille;
+    try
+    {
+        if ((i2c_smbus_access(I2C_SMBUS_READ, _registre, _taille == 32 ? I2C_SMBUS_I2C_BLOCK_BROKEN :
+                              I2C_SMBUS_I2C_BLOCK_DATA, &data)) < 0)
+            throw I2cException(errno, " Erreur Lecture d'un block n° %u", _registre);
+        else
+            memcpy(_valeurs, &data.block[1], data.block[0] );
+    }
+    catch (I2cException const& e)
+    {
+        gestionnaire(e);
+        return 0;
+    }
+    return data.block[0];
+}
+
+/**
+ * @brief I2cBus::LireBlocBrut
+ * @param _registre Adresse du bloc de registre à lire
+ * @param _valeurs  pointeur sur les valeurs lus
+ * @param _taille   nombre d'octets à lire (au plus TAILLE_BLOC_BRUT)
+ * @return          nombre d'octets lus
+ *
+ * @details Lecture en un seul transfert combiné I2C_RDWR : écriture de l'adresse
+ *          du registre puis lecture de _taille octets après un redémarrage,
+ *          directement dans le tampon de l'appelant.
+ */
+int I2cBus::LireBlocBrut(uint8_t _registre, uint8_t *_valeurs, uint16_t _taille)
+{
+    struct i2c_msg messages[2];
+    struct i2c_rdwr_ioctl_data args;
+
+    messages[0].addr = adresse;
+    messages[0].flags = 0;
+    messages[0].len = 1;
+    messages[0].buf = &_registre;
+
+    messages[1].addr = adresse;
+    messages[1].flags = I2C_M_RD;
+    messages[1].len = _taille;
+    messages[1].buf = _valeurs;
+
+    args.msgs = messages;
+    args.nmsgs = 2;
+    try
+    {
+        if (ioctl(fichierI2c, I2C_RDWR, &args) < 0)
+            throw I2cException(errno, " Erreur Lecture brute d'un block n° %u", _registre);
+    }
+    catch (I2cException const& e)
+    {
+        gestionnaire(e);
+        return 0;
+    }
+    return _taille;
+}
+
+/**
+ * @brief I2cBus::i2c_smbus_access
+ * @param _mode     Mode d'accès : I2C_SMBUS_WRITE (ecriture) ou I2C_SMBUS_READ (lecture)
+ * @param _registre adresse du registre affecté par l'opération
+ * @param _taille   Nombre d'octets à lire ou écrire
+ * @param _data     Données à lire ou écrire sur le bus
+ * @return          0 si l'opération a été effectué correctement, -1 en cas d'erreur dans ce cas,
+ *                  errno contient le code d'erreur.
+ *
+ * @details Fonction de bas niveau permettant la lecture et lecriture sur le bus I2c
+ */
+int I2cBus::i2c_smbus_access(char _mode, uint8_t _registre, int _taille, i2c_smbus_data *_data)
+{
+    struct i2c_smbus_ioctl_data args;
+
+    args.read_write = _mode;
+    args.command = _registre;
+    args.size = _taille;
+    args.data = _data;
+    return ioctl(fichierI2c, I2C_SMBUS, &args);
+}
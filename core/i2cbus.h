@@ -0,0 +1,81 @@
+/**
+ * @file    i2cbus.h
+ * @brief   Classe pour gérer le bus i2C sans dépendance au framework QT
+ * @author  Philippe CRUCHET (LPO Touchard-Washington - Le MANS)
+ * @date    15 aout 2018
+ * @version 1.0
+ */
+
+#ifndef I2CBUS_H
+#define I2CBUS_H
+
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <linux/i2c-dev.h>
+#include <linux/i2c.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "i2cexception.h"
+
+class I2cBus
+{
+public:
+    /// Fonction appelée lorsqu'une opération sur le bus échoue. Elle peut terminer
+    /// le programme (GererErreur) ou rendre la main : l'opération renvoie alors
+    /// 0 ou le nombre d'octets effectivement lus, et la transmission en cours
+    /// doit toujours être terminée par TerminerTransmission().
+    typedef void (*GestionnaireErreur)(const I2cException &_erreur);
+
+    /// Chemin utilisé pour les lectures de blocs
+    enum mode_transfert {
+                TRANSFERT_AUTO,     /// Brut si l'adaptateur le permet, sinon SMBus
+                TRANSFERT_SMBUS,    /// Emulation SMBus, par blocs de TAILLE_BLOC_SMBUS octets
+                TRANSFERT_BRUT      /// Transfert I2c combiné (I2C_RDWR), par blocs de TAILLE_BLOC_BRUT octets
+    };
+
+    /// Progression de l'adresse de registre au cours d'une lecture de bloc
+    enum mode_adressage {
+                ADRESSAGE_INCREMENTE,   /// Registres contigus à partir du premier
+                ADRESSAGE_FIXE          /// Toujours le même registre (FIFO)
+    };
+
+    static constexpr uint16_t TAILLE_BLOC_SMBUS = 32;   /// Limite d'un bloc SMBus
+    static constexpr uint16_t TAILLE_BLOC_BRUT = 8192;  /// Limite d'un message I2C_RDWR dans i2c-dev
+
+    explicit I2cBus(const char *_i2cDev = "/dev/i2c-1",
+                    GestionnaireErreur _gestionnaire = GererErreur);
+    virtual ~I2cBus();
+
+    I2cBus(const I2cBus &) = delete;
+    I2cBus& operator =(const I2cBus &) = delete;
+
+    void CommencerTransmission(uint8_t _adresse);
+    void TerminerTransmission();
+    uint8_t LireRegistre(uint8_t _registre);
+    int EcrireRegistre(uint8_t _registre, uint8_t _valeur);
+    int LireBlocRegistres(uint8_t _registre, uint8_t *_valeurs , uint16_t _taille,
+                          mode_transfert _mode = TRANSFERT_AUTO,
+                          mode_adressage _adressage = ADRESSAGE_INCREMENTE);
+    uint16_t LireRegistre16(uint8_t _registre);
+    bool TransfertBrutDisponible() const;
+
+    static void GererErreur(const I2cException &_erreur);
+
+private:
+    std::string i2cDev;                 /// Nom du fichier vers le bus I2c
+    int fichierI2c = 0;                 /// Descripteur de fichier
+    std::mutex mutex;                   /// Mutex pour bloquer l'accès au bus sur le fichier désigné
+    GestionnaireErreur gestionnaire;    /// Traitement des erreurs du bus
+    uint8_t adresse = 0;                /// Adresse du composant en cours de transmission
+    bool transfertBrut = false;         /// L'adaptateur accepte les transferts I2c bruts
+
+    int i2c_smbus_access(char _mode, uint8_t _registre, int _taille, union i2c_smbus_data *_data) ;
+    int LireBlocSMBus(uint8_t _registre, uint8_t *_valeurs, uint16_t _taille);
+    int LireBlocBrut(uint8_t _registre, uint8_t *_valeurs, uint16_t _taille);
+};
+
+#endif // I2CBUS_H
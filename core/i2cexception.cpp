@@ -0,0 +1,46 @@
+/**
+ * @file    i2cexception.cpp
+ * @brief   Exception levée par la bibliothèque de base (sans Qt)
+ * @author  Philippe CRUCHET (LPO Touchard-Washington - Le MANS)
+ * @date    15 aout 2018
+ * @version 1.0
+ */
+
+#include "i2cexception.h"
+
+#include <cstdarg>
+#include <cstdio>
+
+/**
+ * @brief I2cException::I2cException
+ * @param _codeErreur   Code d'erreur (errno en général)
+ * @param _format       Message au format printf, suivi de ses arguments
+ *
+ * @details Le message est mis en forme dans un tableau de taille fixe,
+ *          il est tronqué s'il dépasse sa capacité.
+ */
+I2cException::I2cException(int32_t _codeErreur, const char *_format, ...):
+    code(_codeErreur)
+{
+    va_list arguments;
+    va_start(arguments, _format);
+    vsnprintf(message, sizeof(message), _format, arguments);
+    va_end(arguments);
+
+    snprintf(erreur, sizeof(erreur), "Code Erreur : %d %s", code, message);
+}
+
+int32_t I2cException::ObtenirCode() const
+{
+    return code;
+}
+
+const char *I2cException::ObtenirMessage() const
+{
+    return message;
+}
+
+const char *I2cException::what() const noexcept
+{
+    return erreur;
+}
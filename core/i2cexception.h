@@ -0,0 +1,30 @@
+/**
+ * @file    i2cexception.h
+ * @brief   Exception levée par la bibliothèque de base (sans Qt)
+ * @author  Philippe CRUCHET (LPO Touchard-Washington - Le MANS)
+ * @date    15 aout 2018
+ * @version 1.0
+ */
+
+#ifndef I2CEXCEPTION_H
+#define I2CEXCEPTION_H
+
+#include <exception>
+#include <cstdint>
+
+class I2cException : public std::exception
+{
+public:
+    I2cException(int32_t _codeErreur, const char *_format, ...);
+
+    int32_t ObtenirCode() const;
+    const char *ObtenirMessage() const;
+    const char *what() const noexcept override;
+
+private:
+    int32_t code;
+    char message[128];      /// Message fixe : aucune allocation dynamique
+    char erreur[160];       /// Message complet "Code Erreur : ..."
+};
+
+#endif // I2CEXCEPTION_H
@@ -0,0 +1,225 @@
+/**
+ * @file    registres.h
+ * @brief   Description déclarative des registres d'un composant I2c
+ * @author  Philippe CRUCHET (LPO Touchard-Washington - Le MANS)
+ * @date    15 aout 2018
+ * @version 1.0
+ *
+ * @details Un champ désigne une valeur répartie sur un ou plusieurs registres
+ *          contigus (adresse, largeur, boutisme, plage de bits, signe).
+ *          A partir d'une liste de champs, CalculerPlan() détermine à la
+ *          compilation le plus petit ensemble de lectures de blocs contigus,
+ *          Lire() exécute ces lectures et Decoder() extrait chaque champ
+ *          du tampon obtenu.
+ *
+ *          Exemple :
+ *          @code
+ *          constexpr Registres::Champ champs[] = { Registres::Mot16(0x88, Registres::PETIT_BOUTIEN),
+ *                                                  Registres::Octet(0xA1) };
+ *          constexpr auto plan = Registres::CalculerPlan(champs);
+ *          uint8_t tampon[plan.taille];
+ *          if (Registres::Lire(bus, plan, tampon))
+ *              valeur = Registres::Decoder(plan, 0, tampon);
+ *          @endcode
+ */
+
+#ifndef REGISTRES_H
+#define REGISTRES_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "i2cbus.h"
+
+namespace Registres {
+
+/// Nombre de registres adressables : taille maximale d'un bloc
+constexpr uint16_t TAILLE_ESPACE_REGISTRES = 0x100;
+
+enum Boutisme {
+    PETIT_BOUTIEN,      /// Octet de poids faible à l'adresse la plus basse
+    GRAND_BOUTIEN       /// Octet de poids fort à l'adresse la plus basse
+};
+
+struct Champ {
+    uint8_t  adresse;   /// Adresse du premier registre
+    uint8_t  largeur;   /// Nombre de registres (1 à 4)
+    Boutisme boutisme;  /// Ordre des octets
+    uint8_t  bitBas;    /// Rang du premier bit du champ dans la valeur assemblée
+    uint8_t  nbBits;    /// Nombre de bits du champ
+    bool     signe;     /// Extension de signe à partir du bit de poids fort
+};
+
+struct Bloc {
+    uint8_t registre;   /// Premier registre lu
+    uint16_t taille;    /// Nombre d'octets lus
+    uint16_t position;  /// Position du bloc dans le tampon
+};
+
+template<std::size_t N>
+struct Plan {
+    Champ champs[N];        /// Champs dans l'ordre de déclaration
+    uint16_t positions[N];  /// Position de chaque champ dans le tampon
+    Bloc blocs[N];          /// Lectures à effectuer
+    std::size_t nbBlocs;    /// Nombre de lectures
+    std::size_t taille;     /// Taille du tampon nécessaire
+};
+
+/**
+ * @brief Octet
+ * @param _adresse  Adresse du registre
+ * @param _signe    vrai si la valeur est signée
+ * @return          Champ occupant un registre complet
+ */
+constexpr Champ Octet(uint8_t _adresse, bool _signe = false)
+{
+    return Champ{_adresse, 1, GRAND_BOUTIEN, 0, 8, _signe};
+}
+
+/**
+ * @brief Mot16
+ * @param _adresse  Adresse du premier registre
+ * @param _boutisme Ordre des deux octets
+ * @param _signe    vrai si la valeur est signée
+ * @return          Champ occupant deux registres complets
+ */
+constexpr Champ Mot16(uint8_t _adresse, Boutisme _boutisme, bool _signe = false)
+{
+    return Champ{_adresse, 2, _boutisme, 0, 16, _signe};
+}
+
+/**
+ * @brief Bits
+ * @param _adresse  Adresse du premier registre
+ * @param _largeur  Nombre de registres assemblés
+ * @param _boutisme Ordre des octets
+ * @param _bitBas   Rang du premier bit du champ
+ * @param _nbBits   Nombre de bits du champ
+ * @param _signe    vrai si la valeur est signée
+ * @return          Champ occupant une plage de bits
+ */
+constexpr Champ Bits(uint8_t _adresse, uint8_t _largeur, Boutisme _boutisme,
+                     uint8_t _bitBas, uint8_t _nbBits, bool _signe = false)
+{
+    return Champ{_adresse, _largeur, _boutisme, _bitBas, _nbBits, _signe};
+}
+
+/**
+ * @brief CalculerPlan
+ * @param _champs   Champs à lire
+ * @param _tailleMax Taille maximale d'un bloc, sans limite par défaut
+ * @param _ecartMax Nombre de registres inutiles que l'on accepte de lire
+ *                  pour fusionner deux blocs voisins
+ * @return          Plan de lecture
+ *
+ * @details Les champs sont triés par adresse puis regroupés en blocs contigus
+ *          tant que la taille du bloc ne dépasse pas _tailleMax. Les champs
+ *          qui se recouvrent partagent les mêmes octets du tampon.
+ *          La taille des blocs n'a pas à suivre le chemin de transfert :
+ *          I2cBus::LireBlocRegistres() découpe lui-même chaque bloc en
+ *          échanges de 32 octets en SMBus, ou de 8192 octets en brut.
+ *          _tailleMax permet seulement de limiter volontairement un échange.
+ */
+template<std::size_t N>
+constexpr Plan<N> CalculerPlan(const Champ (&_champs)[N], uint16_t _tailleMax = TAILLE_ESPACE_REGISTRES,
+                               uint8_t _ecartMax = 0)
+{
+    Plan<N> plan{};
+    std::size_t ordre[N] = {};
+
+    for (std::size_t i = 0; i < N; i++) {
+        plan.champs[i] = _champs[i];
+        std::size_t j = i;
+        while (j > 0 && _champs[ordre[j - 1]].adresse > _champs[i].adresse) {
+            ordre[j] = ordre[j - 1];
+            j--;
+        }
+        ordre[j] = i;
+    }
+
+    int debut = -1;
+    int fin = -1;       // premier registre après le bloc courant
+    for (std::size_t i = 0; i < N; i++) {
+        const Champ &champ = _champs[ordre[i]];
+        int finChamp = champ.adresse + champ.largeur;
+        int nouvelleFin = finChamp > fin ? finChamp : fin;
+
+        if (debut < 0 || champ.adresse > fin + _ecartMax || nouvelleFin - debut > _tailleMax) {
+            if (debut >= 0) {
+                plan.blocs[plan.nbBlocs++] = Bloc{uint8_t(debut), uint16_t(fin - debut), uint16_t(plan.taille)};
+                plan.taille += fin - debut;
+            }
+            debut = champ.adresse;
+            nouvelleFin = finChamp;
+        }
+        fin = nouvelleFin;
+        plan.positions[ordre[i]] = uint16_t(plan.taille + champ.adresse - debut);
+    }
+    if (debut >= 0) {
+        plan.blocs[plan.nbBlocs++] = Bloc{uint8_t(debut), uint16_t(fin - debut), uint16_t(plan.taille)};
+        plan.taille += fin - debut;
+    }
+    return plan;
+}
+
+/**
+ * @brief Decoder
+ * @param _champ    Description du champ
+ * @param _donnees  Octets lus à partir de l'adresse du champ
+ * @return          Valeur du champ, étendue en signe si nécessaire
+ */
+constexpr int32_t Decoder(const Champ &_champ, const uint8_t *_donnees)
+{
+    uint32_t valeur = 0;
+    for (uint8_t i = 0; i < _champ.largeur; i++)
+        valeur = (valeur << 8) | _donnees[_champ.boutisme == GRAND_BOUTIEN ? i : _champ.largeur - 1 - i];
+
+    valeur >>= _champ.bitBas;
+    if (_champ.nbBits < 32) {
+        uint32_t masque = (uint32_t(1) << _champ.nbBits) - 1;
+        valeur &= masque;
+        if (_champ.signe && (valeur & (uint32_t(1) << (_champ.nbBits - 1))))
+            valeur |= ~masque;
+    }
+    return int32_t(valeur);
+}
+
+/**
+ * @brief Decoder
+ * @param _plan     Plan ayant servi à la lecture
+ * @param _indice   Rang du champ dans la liste fournie à CalculerPlan()
+ * @param _tampon   Tampon rempli par Lire()
+ * @return          Valeur du champ
+ */
+template<std::size_t N>
+constexpr int32_t Decoder(const Plan<N> &_plan, std::size_t _indice, const uint8_t *_tampon)
+{
+    return Decoder(_plan.champs[_indice], _tampon + _plan.positions[_indice]);
+}
+
+/**
+ * @brief Lire
+ * @param _bus      Bus sur lequel la transmission a été commencée
+ * @param _plan     Plan de lecture
+ * @param _tampon   Tampon d'au moins _plan.taille octets
+ * @param _mode     Chemin utilisé pour les lectures de blocs
+ * @return          vrai si tous les blocs ont été lus entièrement
+ *
+ * @details L'appel de la méthode CommencerTransmission() est nécessaire avant
+ *          pour désigner l'adresse du composant et prendre le bus pour l'échange.
+ */
+template<std::size_t N>
+bool Lire(I2cBus &_bus, const Plan<N> &_plan, uint8_t *_tampon,
+          I2cBus::mode_transfert _mode = I2cBus::TRANSFERT_AUTO)
+{
+    for (std::size_t i = 0; i < _plan.nbBlocs; i++) {
+        const Bloc &bloc = _plan.blocs[i];
+        if (_bus.LireBlocRegistres(bloc.registre, _tampon + bloc.position, bloc.taille, _mode) != bloc.taille)
+            return false;
+    }
+    return true;
+}
+
+} // namespace Registres
+
+#endif // REGISTRES_H
@@ -0,0 +1,48 @@
+/**
+ * @file    qi2cbus.cpp
+ * @brief   Classe pour gérer le bus i2C avec le framework QT
+ * @author  Philippe CRUCHET (LPO Touchard-Washington - Le MANS)
+ * @date    15 aout 2018
+ * @version 1.0
+ */
+
+#include "qi2cbus.h"
+#include "capteurexception.h"
+
+#include <QDebug>
+
+/**
+ * @brief Qi2cBus::Qi2cBus
+ * @param _i2cDev   Nom du fichier désignant le bus i2c (/dev/i2c-X avec X = 0,1,2...)
+ * @param _parent   Pointeur vers l'objet parent
+ *
+ * @details Ouvre le fichier en question
+ */
+Qi2cBus::Qi2cBus(QString _i2cDev, QObject *_parent) :
+    QObject(_parent),
+    I2cBus(_i2cDev.toLocal8Bit().constData(), GererErreur)
+{
+}
+
+/**
+ * @brief Qi2cBus::~Qi2cBus
+ *
+ * @details Destructeur de la classe, le fichier est fermé par I2cBus
+ */
+Qi2cBus::~Qi2cBus()
+{
+}
+
+/**
+ * @brief Qi2cBus::GererErreur
+ * @param _erreur   Exception levée par la bibliothèque de base
+ *
+ * @details Convertit l'erreur en CapteurException, l'affiche avec qDebug()
+ *          et termine le programme avec le code d'erreur.
+ */
+void Qi2cBus::GererErreur(const I2cException &_erreur)
+{
+    CapteurException e(_erreur.ObtenirCode(), QString::fromLocal8Bit(_erreur.ObtenirMessage()));
+    qDebug() << e.ObtenirErreur();
+    exit(_erreur.ObtenirCode());
+}
@@ -0,0 +1,34 @@
+/**
+ * @file    qi2cbus.h
+ * @brief   Classe pour gérer le bus i2C avec le framework QT
+ * @author  Philippe CRUCHET (LPO Touchard-Washington - Le MANS)
+ * @date    15 aout 2018
+ * @version 1.0
+ */
+
+#ifndef QI2CBUS_H
+#define QI2CBUS_H
+
+#include <QObject>
+
+#include "i2cbus.h"
+
+/**
+ * @brief La classe Qi2cBus
+ *
+ * @details Enveloppe QT du bus I2c de la bibliothèque de base. Les accès au bus
+ *          sont ceux de I2cBus, seules les erreurs sont remontées sous la forme
+ *          d'une CapteurException affichée avec qDebug().
+ */
+class Qi2cBus : public QObject, public I2cBus
+{
+    Q_OBJECT
+public:
+    explicit Qi2cBus(QString _i2cDev = "/dev/i2c-1", QObject *_parent = nullptr);
+    virtual ~Qi2cBus();
+
+private:
+    static void GererErreur(const I2cException &_erreur);
+};
+
+#endif // QI2CBUS_H
@@ -0,0 +1,26 @@
+# Enveloppe Qt de la bibliothèque de base.
+QT += core
+QT -= gui
+
+CONFIG += c++11
+CONFIG += staticlib
+
+TARGET = CapteursI2CQt
+
+TEMPLATE = lib
+
+INCLUDEPATH += ../core
+DEPENDPATH += ../core
+
+SOURCES += qi2cbus.cpp \
+    capteurexception.cpp
+
+# The following define makes your compiler emit warnings if you use
+# any feature of Qt which as been marked deprecated (the exact warnings
+# depend on your compiler). Please consult the documentation of the
+# deprecated API in order to know how to port your code away from it.
+DEFINES += QT_DEPRECATED_WARNINGS
+
+HEADERS += \
+    qi2cbus.h \
+    capteurexception.h